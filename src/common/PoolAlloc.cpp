@@ -365,7 +365,7 @@ void *PoolAllocator::allocate(size_t numBytes)
     ASSERT(allocationSize >= numBytes);
 
     // Do the allocation, most likely case first, for efficiency.
-    if (allocationSize <= mPageSize - mCurrentPageOffset)
+    if (ANGLE_LIKELY(allocationSize <= mPageSize - mCurrentPageOffset))
     {
         // There is enough room to allocate from the current page at mCurrentPageOffset.
         uint8_t *memory = currentPagePtr + preAllocationPadding;
@@ -374,7 +374,7 @@ void *PoolAllocator::allocate(size_t numBytes)
         return initializeAllocation(memory, numBytes);
     }
 
-    if (allocationSize > mPageSize - mPageHeaderSkip)
+    if (ANGLE_UNLIKELY(allocationSize > mPageSize - mPageHeaderSkip))
     {
         // If the allocation is larger than a whole page, do a multi-page allocation.  These are not
         // mixed with the others.  The OS is efficient in allocating and freeing multiple pages.
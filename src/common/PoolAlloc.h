@@ -110,7 +110,7 @@ class PoolAllocator : angle::NonCopyable
         //
         // Do the allocation, most likely case inline first, for efficiency.
         //
-        if (numBytes <= mPageSize - mCurrentPageOffset)
+        if (ANGLE_LIKELY(numBytes <= mPageSize - mCurrentPageOffset))
         {
             //
             // Safe to allocate from mCurrentPageOffset.
@@ -10,6 +10,8 @@
 #ifndef COMMON_SPINLOCK_H_
 #define COMMON_SPINLOCK_H_
 
+#include <atomic>
+
 #include "common/angleutils.h"
 
 #ifdef _MSC_VER
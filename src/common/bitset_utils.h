@@ -340,14 +340,9 @@ template <size_t N, typename BitsT, typename ParamT>
 constexpr BitSetT<N, BitsT, ParamT> &BitSetT<N, BitsT, ParamT>::set(ParamT pos, bool value)
 {
     ASSERT(static_cast<size_t>(pos) < N);
-    if (value)
-    {
-        mBits |= Bit<BitsT>(pos);
-    }
-    else
-    {
-        reset(pos);
-    }
+    // Branchless update; all-ones when value is true, all-zeros when it is false.
+    const BitsT mask = Bit<BitsT>(pos);
+    mBits            = (mBits & ~mask) | (mask & (BitsT(0) - static_cast<BitsT>(value)));
     ASSERT(mBits == (mBits & Mask(N).bits()));
     return *this;
 }
@@ -367,6 +367,7 @@ void DirectiveParser::parseDefine(Token *token)
         // the replacement list for either form of macro.
         macro->replacements.front().setHasLeadingSpace(false);
     }
+    macro->indexParameters();
 
     // Check for macro redefinition.
     MacroSet::const_iterator iter = mMacroSet->find(macro->name);
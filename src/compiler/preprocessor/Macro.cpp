@@ -6,7 +6,10 @@
 
 #include "compiler/preprocessor/Macro.h"
 
+#include <algorithm>
+
 #include "common/angleutils.h"
+#include "common/debug.h"
 #include "compiler/preprocessor/Token.h"
 
 namespace angle
@@ -25,6 +28,26 @@ bool Macro::equals(const Macro &other) const
            (replacements == other.replacements);
 }
 
+void Macro::indexParameters()
+{
+    ASSERT(parameterIndices.empty());
+    parameterIndices.reserve(replacements.size());
+    for (const Token &repl : replacements)
+    {
+        int index = -1;
+        if (repl.type == Token::IDENTIFIER)
+        {
+            Parameters::const_iterator iter =
+                std::find(parameters.cbegin(), parameters.cend(), repl.text);
+            if (iter != parameters.cend())
+            {
+                index = static_cast<int>(std::distance(parameters.cbegin(), iter));
+            }
+        }
+        parameterIndices.push_back(index);
+    }
+}
+
 void PredefineMacro(MacroSet *macroSet, const char *name, int value)
 {
     Token token;
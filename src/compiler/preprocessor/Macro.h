@@ -34,6 +34,10 @@ struct Macro
     ~Macro();
     bool equals(const Macro &other) const;
 
+    // Computes parameterIndices from parameters and replacements. Must be called once a
+    // function-like macro is fully parsed, before it is expanded.
+    void indexParameters();
+
     bool predefined;
     mutable bool disabled;
     mutable int expansionCount;
@@ -42,6 +46,9 @@ struct Macro
     std::string name;
     Parameters parameters;
     Replacements replacements;
+    // For each replacement token, the index of the parameter the token names, or -1. Computed
+    // once at definition so that expansion does not search the parameter list for every token.
+    std::vector<int> parameterIndices;
 };
 
 typedef std::map<std::string, std::shared_ptr<Macro>> MacroSet;
@@ -105,6 +105,10 @@ MacroExpander::~MacroExpander()
     {
         delete context;
     }
+    for (MacroContext *context : mFreeContexts)
+    {
+        delete context;
+    }
 }
 
 void MacroExpander::lex(Token *token)
@@ -168,7 +172,11 @@ void MacroExpander::lex(Token *token)
         if (iter == mMacroSet->end())
             break;
 
-        std::shared_ptr<Macro> macro = iter->second;
+        // A reference into the macro set stays valid for the whole expansion: the entry cannot be
+        // removed while the macro is being expanded, since #undef reports an error instead of
+        // erasing a macro whose expansionCount is non-zero. Not copying the shared_ptr here
+        // avoids reference count churn on every expanded identifier.
+        const std::shared_ptr<Macro> &macro = iter->second;
         if (macro->disabled)
         {
             // If a particular token is not expanded, it is never expanded.
@@ -243,23 +251,24 @@ bool MacroExpander::isNextTokenLeftParen()
     return lparen;
 }
 
-bool MacroExpander::pushMacro(std::shared_ptr<Macro> macro, const Token &identifier)
+bool MacroExpander::pushMacro(const std::shared_ptr<Macro> &macro, const Token &identifier)
 {
     ASSERT(!macro->disabled);
     ASSERT(!identifier.expansionDisabled());
     ASSERT(identifier.type == Token::IDENTIFIER);
     ASSERT(identifier.text == macro->name);
 
-    std::vector<Token> replacements;
-    if (!expandMacro(*macro, identifier, &replacements))
+    MacroContext *context = acquireContext();
+    if (!expandMacro(*macro, identifier, &context->replacements))
+    {
+        releaseContext(context);
         return false;
+    }
 
     // Macro is disabled for expansion until it is popped off the stack.
     macro->disabled = true;
 
-    MacroContext *context = new MacroContext;
-    context->macro        = macro;
-    context->replacements.swap(replacements);
+    context->macro = macro;
     mContextStack.push_back(context);
     mTotalTokensInContexts += context->replacements.size();
     return true;
@@ -275,17 +284,34 @@ void MacroExpander::popMacro()
     ASSERT(context->empty());
     ASSERT(context->macro->disabled);
     ASSERT(context->macro->expansionCount > 0);
+    context->macro->expansionCount--;
     if (mDeferReenablingMacros)
     {
-        mMacrosToReenable.push_back(context->macro);
+        mMacrosToReenable.push_back(std::move(context->macro));
     }
     else
     {
         context->macro->disabled = false;
     }
-    context->macro->expansionCount--;
     mTotalTokensInContexts -= context->replacements.size();
-    delete context;
+    releaseContext(context);
+}
+
+MacroExpander::MacroContext *MacroExpander::acquireContext()
+{
+    if (mFreeContexts.empty())
+    {
+        return new MacroContext;
+    }
+    MacroContext *context = mFreeContexts.back();
+    mFreeContexts.pop_back();
+    return context;
+}
+
+void MacroExpander::releaseContext(MacroContext *context)
+{
+    context->reset();
+    mFreeContexts.push_back(context);
 }
 
 bool MacroExpander::expandMacro(const Macro &macro,
@@ -481,19 +507,17 @@ void MacroExpander::replaceMacroParams(const Macro &macro,
             continue;
         }
 
-        // TODO(alokp): Optimize this.
-        // There is no need to search for macro params every time.
-        // The param index can be cached with the replacement token.
-        Macro::Parameters::const_iterator iter =
-            std::find(macro.parameters.begin(), macro.parameters.end(), repl.text);
-        if (iter == macro.parameters.end())
+        // The parameter index was computed once when the macro was defined; there is no need to
+        // search the parameter list for every expanded token.
+        ASSERT(macro.parameterIndices.size() == macro.replacements.size());
+        const int paramIndex = macro.parameterIndices[i];
+        if (paramIndex < 0)
         {
             replacements->push_back(repl);
             continue;
         }
 
-        std::size_t iArg    = std::distance(macro.parameters.begin(), iter);
-        const MacroArg &arg = args[iArg];
+        const MacroArg &arg = args[paramIndex];
         if (arg.empty())
         {
             continue;
@@ -526,6 +550,14 @@ void MacroExpander::MacroContext::unget()
     --index;
 }
 
+void MacroExpander::MacroContext::reset()
+{
+    macro.reset();
+    index = 0;
+    // clear() keeps the buffer's capacity for the next expansion that reuses this context.
+    replacements.clear();
+}
+
 }  // namespace pp
 
 }  // namespace angle
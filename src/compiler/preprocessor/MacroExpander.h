@@ -10,6 +10,7 @@
 #include <memory>
 #include <vector>
 
+#include "common/FastVector.h"
 #include "compiler/preprocessor/Lexer.h"
 #include "compiler/preprocessor/Macro.h"
 #include "compiler/preprocessor/Preprocessor.h"
@@ -40,7 +41,7 @@ class MacroExpander : public Lexer
     void ungetToken(const Token &token);
     bool isNextTokenLeftParen();
 
-    bool pushMacro(std::shared_ptr<Macro> macro, const Token &identifier);
+    bool pushMacro(const std::shared_ptr<Macro> &macro, const Token &identifier);
     void popMacro();
 
     bool expandMacro(const Macro &macro, const Token &identifier, std::vector<Token> *replacements);
@@ -61,19 +62,30 @@ class MacroExpander : public Lexer
         bool empty() const;
         const Token &get();
         void unget();
+        void reset();
 
         std::shared_ptr<Macro> macro;
         std::size_t index;
         std::vector<Token> replacements;
     };
 
+    // Gets a context from the freelist if possible so that pushing a macro does not have to
+    // allocate a new context (and its token buffer) for every expansion.
+    MacroContext *acquireContext();
+    void releaseContext(MacroContext *context);
+
     Lexer *mLexer;
     MacroSet *mMacroSet;
     Diagnostics *mDiagnostics;
     bool mParseDefined;
 
     std::unique_ptr<Token> mReserveToken;
-    std::vector<MacroContext *> mContextStack;
+    // Macro expansions rarely nest more than a few levels deep, so both stacks normally stay
+    // within their inline storage and never touch the heap.
+    FastVector<MacroContext *, 8> mContextStack;
+    // Contexts that have been popped off the stack, kept for reuse. The cached contexts retain
+    // the capacity of their replacement buffers, so steady-state expansion does not allocate.
+    FastVector<MacroContext *, 8> mFreeContexts;
     size_t mTotalTokensInContexts;
 
     PreprocessorSettings mSettings;
@@ -5,6 +5,9 @@
 //
 
 #include "compiler/translator/BuiltInFunctionEmulator.h"
+
+#include <algorithm>
+
 #include "angle_gl.h"
 #include "compiler/translator/Symbol.h"
 #include "compiler/translator/tree_util/IntermTraverse.h"
@@ -12,6 +15,21 @@
 namespace sh
 {
 
+namespace
+{
+
+// Finds the position of uniqueId in a flat map sorted by id, or the position where it should be
+// inserted.
+template <typename Pair>
+typename std::vector<Pair>::const_iterator FindById(const std::vector<Pair> &flatMap, int uniqueId)
+{
+    return std::lower_bound(
+        flatMap.begin(), flatMap.end(), uniqueId,
+        [](const Pair &entry, int value) { return entry.first < value; });
+}
+
+}  // anonymous namespace
+
 class BuiltInFunctionEmulator::BuiltInFunctionEmulationMarker : public TIntermTraverser
 {
   public:
@@ -53,7 +71,16 @@ BuiltInFunctionEmulator::BuiltInFunctionEmulator() {}
 void BuiltInFunctionEmulator::addEmulatedFunction(const TSymbolUniqueId &uniqueId,
                                                   const char *emulatedFunctionDefinition)
 {
-    mEmulatedFunctions[uniqueId.get()] = std::string(emulatedFunctionDefinition);
+    auto iter = FindById(mEmulatedFunctions, uniqueId.get());
+    if (iter != mEmulatedFunctions.end() && iter->first == uniqueId.get())
+    {
+        mEmulatedFunctions[iter - mEmulatedFunctions.begin()].second = emulatedFunctionDefinition;
+    }
+    else
+    {
+        mEmulatedFunctions.insert(iter,
+                                  std::make_pair(uniqueId.get(), emulatedFunctionDefinition));
+    }
 }
 
 void BuiltInFunctionEmulator::addEmulatedFunctionWithDependency(
@@ -61,8 +88,17 @@ void BuiltInFunctionEmulator::addEmulatedFunctionWithDependency(
     const TSymbolUniqueId &uniqueId,
     const char *emulatedFunctionDefinition)
 {
-    mEmulatedFunctions[uniqueId.get()]    = std::string(emulatedFunctionDefinition);
-    mFunctionDependencies[uniqueId.get()] = dependency.get();
+    addEmulatedFunction(uniqueId, emulatedFunctionDefinition);
+
+    auto iter = FindById(mFunctionDependencies, uniqueId.get());
+    if (iter != mFunctionDependencies.end() && iter->first == uniqueId.get())
+    {
+        mFunctionDependencies[iter - mFunctionDependencies.begin()].second = dependency.get();
+    }
+    else
+    {
+        mFunctionDependencies.insert(iter, std::make_pair(uniqueId.get(), dependency.get()));
+    }
 }
 
 bool BuiltInFunctionEmulator::isOutputEmpty() const
@@ -92,8 +128,8 @@ const char *BuiltInFunctionEmulator::findEmulatedFunction(int uniqueId) const
         }
     }
 
-    const auto &result = mEmulatedFunctions.find(uniqueId);
-    if (result != mEmulatedFunctions.end())
+    auto result = FindById(mEmulatedFunctions, uniqueId);
+    if (result != mEmulatedFunctions.end() && result->first == uniqueId)
     {
         return result->second.c_str();
     }
@@ -120,10 +156,10 @@ bool BuiltInFunctionEmulator::setFunctionCalled(int uniqueId)
             return true;
     }
     // If the function depends on another, mark the dependency as called.
-    auto dependency = mFunctionDependencies.find(uniqueId);
-    if (dependency != mFunctionDependencies.end())
+    auto dependency = FindById(mFunctionDependencies, uniqueId);
+    if (dependency != mFunctionDependencies.end() && dependency->first == uniqueId)
     {
-        setFunctionCalled((*dependency).second);
+        setFunctionCalled(dependency->second);
     }
     mFunctions.push_back(uniqueId);
     return true;
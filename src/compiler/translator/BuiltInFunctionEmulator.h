@@ -61,12 +61,14 @@ class BuiltInFunctionEmulator
 
     const char *findEmulatedFunction(int uniqueId) const;
 
-    // Map from function unique id to emulated function definition
-    std::map<int, std::string> mEmulatedFunctions;
-
-    // Map from dependent functions to their dependencies. This structure allows each function to
-    // have at most one dependency.
-    std::map<int, int> mFunctionDependencies;
+    // Map from function unique id to emulated function definition, stored as a flat vector sorted
+    // by id. There are few enough entries that binary search over contiguous storage beats a
+    // node-based map.
+    std::vector<std::pair<int, std::string>> mEmulatedFunctions;
+
+    // Map from dependent functions to their dependencies, sorted by dependent function id. This
+    // structure allows each function to have at most one dependency.
+    std::vector<std::pair<int, int>> mFunctionDependencies;
 
     // Called function ids
     std::vector<int> mFunctions;
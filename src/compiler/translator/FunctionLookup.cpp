@@ -22,17 +22,17 @@ constexpr const ImmutableString kEmptyName("");
 
 // Helper function for GetMangledNames
 // Gets all ordered combinations of elements in list[currentIndex, end]
-std::vector<std::vector<int>> GetImplicitConversionCombinations(const std::vector<int> &list)
+TVector<TVector<int>> GetImplicitConversionCombinations(const TVector<int> &list)
 {
-    std::vector<std::vector<int>> target;
-    target.push_back(std::vector<int>());
+    TVector<TVector<int>> target;
+    target.push_back(TVector<int>());
 
     for (size_t currentIndex = 0; currentIndex < list.size(); currentIndex++)
     {
         size_t prevIterSize = target.size();
         for (size_t copyIndex = 0; copyIndex < prevIterSize; copyIndex++)
         {
-            std::vector<int> combination = target[copyIndex];
+            TVector<int> combination = target[copyIndex];
             combination.push_back(list[currentIndex]);
             target.push_back(combination);
         }
@@ -77,22 +77,29 @@ ImmutableString TFunctionLookup::getMangledName() const
 ImmutableString TFunctionLookup::GetMangledName(const char *functionName,
                                                 const TIntermSequence &arguments)
 {
-    std::string newName(functionName);
-    newName += kFunctionMangledNameSeparator;
+    // Size the string first so the mangled name is written straight into a single pool
+    // allocation instead of being built in a std::string and then copied.
+    size_t nameLength = strlen(functionName) + 1u;
+    for (TIntermNode *argument : arguments)
+    {
+        nameLength += strlen(argument->getAsTyped()->getType().getMangledName());
+    }
 
+    ImmutableStringBuilder newName(nameLength);
+    newName << functionName << kFunctionMangledNameSeparator;
     for (TIntermNode *argument : arguments)
     {
-        newName += argument->getAsTyped()->getType().getMangledName();
+        newName << argument->getAsTyped()->getType().getMangledName();
     }
-    return ImmutableString(newName);
+    return newName;
 }
 
-std::vector<ImmutableString> GetMangledNames(const char *functionName,
-                                             const TIntermSequence &arguments)
+TVector<ImmutableString> GetMangledNames(const char *functionName,
+                                         const TIntermSequence &arguments)
 {
-    std::vector<ImmutableString> target;
+    TVector<ImmutableString> target;
 
-    std::vector<int> indexes;
+    TVector<int> indexes;
     for (int i = 0; i < static_cast<int>(arguments.size()); i++)
     {
         TIntermNode *argument = arguments[i];
@@ -103,8 +110,8 @@ std::vector<ImmutableString> GetMangledNames(const char *functionName,
         }
     }
 
-    std::vector<std::vector<int>> combinations = GetImplicitConversionCombinations(indexes);
-    for (const std::vector<int> &combination : combinations)
+    TVector<TVector<int>> combinations = GetImplicitConversionCombinations(indexes);
+    for (const TVector<int> &combination : combinations)
     {
         // combination: ordered list of indexes for arguments that should be converted to float
         std::string newName(functionName);
@@ -136,7 +143,7 @@ std::vector<ImmutableString> GetMangledNames(const char *functionName,
     return target;
 }
 
-std::vector<ImmutableString> TFunctionLookup::getMangledNamesForImplicitConversions() const
+TVector<ImmutableString> TFunctionLookup::getMangledNamesForImplicitConversions() const
 {
     return GetMangledNames(mName.data(), mArguments);
 }
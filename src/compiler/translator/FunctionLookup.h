@@ -28,7 +28,7 @@ class TFunctionLookup : angle::NonCopyable
     ImmutableString getMangledName() const;
     static ImmutableString GetMangledName(const char *functionName,
                                           const TIntermSequence &arguments);
-    std::vector<ImmutableString> getMangledNamesForImplicitConversions() const;
+    TVector<ImmutableString> getMangledNamesForImplicitConversions() const;
 
     bool isConstructor() const;
     const TType &constructorType() const;
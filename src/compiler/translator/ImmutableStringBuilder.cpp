@@ -14,11 +14,55 @@
 namespace sh
 {
 
+namespace
+{
+
+// Most strings appended while building names are only a handful of characters long.  Dispatching
+// on the size lets the compiler expand each fixed-size memcpy into a single load/store pair
+// instead of calling into libc for every append.
+inline void AppendSmall(char *dst, const char *src, size_t len)
+{
+    switch (len)
+    {
+        case 0:
+            return;
+        case 1:
+            memcpy(dst, src, 1);
+            return;
+        case 2:
+            memcpy(dst, src, 2);
+            return;
+        case 3:
+            memcpy(dst, src, 3);
+            return;
+        case 4:
+            memcpy(dst, src, 4);
+            return;
+        case 5:
+            memcpy(dst, src, 5);
+            return;
+        case 6:
+            memcpy(dst, src, 6);
+            return;
+        case 7:
+            memcpy(dst, src, 7);
+            return;
+        case 8:
+            memcpy(dst, src, 8);
+            return;
+        default:
+            memcpy(dst, src, len);
+            return;
+    }
+}
+
+}  // anonymous namespace
+
 ImmutableStringBuilder &ImmutableStringBuilder::operator<<(const ImmutableString &str)
 {
     ASSERT(mData != nullptr);
     ASSERT(mPos + str.length() <= mMaxLength);
-    memcpy(mData + mPos, str.data(), str.length());
+    AppendSmall(mData + mPos, str.data(), str.length());
     mPos += str.length();
     return *this;
 }
@@ -28,7 +72,7 @@ ImmutableStringBuilder &ImmutableStringBuilder::operator<<(const char *str)
     ASSERT(mData != nullptr);
     size_t len = strlen(str);
     ASSERT(mPos + len <= mMaxLength);
-    memcpy(mData + mPos, str, len);
+    AppendSmall(mData + mPos, str, len);
     mPos += len;
     return *this;
 }
@@ -7,34 +7,40 @@
 #include "compiler/translator/PoolAlloc.h"
 
 #include "common/debug.h"
-#include "common/tls.h"
 
-angle::TLSIndex PoolIndex = TLS_INVALID_INDEX;
+namespace
+{
+// The current per-thread pool allocator. Using a C++11 thread_local instead of a dynamic TLS
+// index makes the lookup a direct TLS load rather than a call through the TLS API on every
+// pool allocation.
+thread_local angle::PoolAllocator *gPoolAllocator = nullptr;
+
+// Tracks ShInitialize/ShFinalize pairing, mirroring the checks the dynamic TLS index used to
+// provide.
+bool gPoolIndexInitialized = false;
+}  // anonymous namespace
 
 bool InitializePoolIndex()
 {
-    ASSERT(PoolIndex == TLS_INVALID_INDEX);
-
-    PoolIndex = angle::CreateTLSIndex(nullptr);
-    return PoolIndex != TLS_INVALID_INDEX;
+    ASSERT(!gPoolIndexInitialized);
+    gPoolIndexInitialized = true;
+    return true;
 }
 
 void FreePoolIndex()
 {
-    ASSERT(PoolIndex != TLS_INVALID_INDEX);
-
-    angle::DestroyTLSIndex(PoolIndex);
-    PoolIndex = TLS_INVALID_INDEX;
+    ASSERT(gPoolIndexInitialized);
+    gPoolIndexInitialized = false;
 }
 
 angle::PoolAllocator *GetGlobalPoolAllocator()
 {
-    ASSERT(PoolIndex != TLS_INVALID_INDEX);
-    return static_cast<angle::PoolAllocator *>(angle::GetTLSValue(PoolIndex));
+    ASSERT(gPoolIndexInitialized);
+    return gPoolAllocator;
 }
 
 void SetGlobalPoolAllocator(angle::PoolAllocator *poolAllocator)
 {
-    ASSERT(PoolIndex != TLS_INVALID_INDEX);
-    angle::SetTLSValue(PoolIndex, poolAllocator);
+    ASSERT(gPoolIndexInitialized);
+    gPoolAllocator = poolAllocator;
 }
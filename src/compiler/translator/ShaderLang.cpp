@@ -11,6 +11,10 @@
 
 #include "GLSLANG/ShaderLang.h"
 
+#include <mutex>
+#include <unordered_set>
+
+#include "common/Spinlock.h"
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/InitializeDll.h"
 #include "compiler/translator/length_limits.h"
@@ -33,6 +37,38 @@ bool isInitialized = false;
 // and the shading language compiler.
 //
 
+#if defined(ANGLE_ENABLE_ASSERTS)
+// Process-wide registry of handles returned by ConstructCompiler() and not yet destroyed.  It
+// makes validating a handle an O(1) hash probe instead of trusting the caller blindly.  The
+// registry is only maintained when asserts are enabled so that release builds stay zero-cost.
+angle::Spinlock sLiveCompilerHandlesLock;
+
+std::unordered_set<ShHandle> &LiveCompilerHandles()
+{
+    // Intentionally leaked to avoid a global destructor.
+    static std::unordered_set<ShHandle> *const kLiveHandles = new std::unordered_set<ShHandle>;
+    return *kLiveHandles;
+}
+
+void AddLiveCompilerHandle(ShHandle handle)
+{
+    std::lock_guard<angle::Spinlock> lock(sLiveCompilerHandlesLock);
+    LiveCompilerHandles().insert(handle);
+}
+
+void RemoveLiveCompilerHandle(ShHandle handle)
+{
+    std::lock_guard<angle::Spinlock> lock(sLiveCompilerHandlesLock);
+    LiveCompilerHandles().erase(handle);
+}
+
+bool IsLiveCompilerHandle(ShHandle handle)
+{
+    std::lock_guard<angle::Spinlock> lock(sLiveCompilerHandlesLock);
+    return LiveCompilerHandles().count(handle) != 0;
+}
+#endif  // defined(ANGLE_ENABLE_ASSERTS)
+
 template <typename VarT>
 const std::vector<VarT> *GetVariableList(const TCompiler *compiler);
 
@@ -49,6 +85,10 @@ TCompiler *GetCompilerFromHandle(ShHandle handle)
         return nullptr;
     }
 
+#if defined(ANGLE_ENABLE_ASSERTS)
+    ASSERT(IsLiveCompilerHandle(handle));
+#endif
+
     TShHandleBase *base = static_cast<TShHandleBase *>(handle);
     return base->getAsCompiler();
 }
@@ -361,6 +401,10 @@ ShHandle ConstructCompiler(sh::GLenum type,
         return 0;
     }
 
+#if defined(ANGLE_ENABLE_ASSERTS)
+    AddLiveCompilerHandle(base);
+#endif
+
     return base;
 }
 
@@ -371,6 +415,10 @@ void Destruct(ShHandle handle)
 
     TShHandleBase *base = static_cast<TShHandleBase *>(handle);
 
+#if defined(ANGLE_ENABLE_ASSERTS)
+    RemoveLiveCompilerHandle(handle);
+#endif
+
     if (base->getAsCompiler())
         DeleteCompiler(base->getAsCompiler());
 }
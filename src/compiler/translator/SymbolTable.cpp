@@ -58,28 +58,6 @@ bool CheckExtension(uint32_t extensionIndex, const ShBuiltInResources &resources
 }
 }  // namespace
 
-class TSymbolTable::TSymbolTableLevel
-{
-  public:
-    TSymbolTableLevel() = default;
-
-    bool insert(TSymbol *symbol);
-
-    // Insert a function using its unmangled name as the key.
-    void insertUnmangled(TFunction *function);
-
-    TSymbol *find(const ImmutableString &name) const;
-
-  private:
-    using tLevel        = TUnorderedMap<ImmutableString,
-                                 TSymbol *,
-                                 ImmutableString::FowlerNollVoHash<sizeof(size_t)>>;
-    using tLevelPair    = const tLevel::value_type;
-    using tInsertResult = std::pair<tLevel::iterator, bool>;
-
-    tLevel level;
-};
-
 bool TSymbolTable::TSymbolTableLevel::insert(TSymbol *symbol)
 {
     // returning true means symbol was added to the table
@@ -123,8 +101,8 @@ bool TSymbolTable::atGlobalLevel() const
 
 void TSymbolTable::push()
 {
-    mTable.emplace_back(new TSymbolTableLevel);
-    mPrecisionStack.emplace_back(new PrecisionStackLevel);
+    mTable.emplace_back();
+    mPrecisionStack.emplace_back();
 }
 
 void TSymbolTable::pop()
@@ -265,7 +243,7 @@ const TSymbol *TSymbolTable::findUserDefined(const ImmutableString &name) const
     int userDefinedLevel = static_cast<int>(mTable.size()) - 1;
     while (userDefinedLevel >= 0)
     {
-        const TSymbol *symbol = mTable[userDefinedLevel]->find(name);
+        const TSymbol *symbol = mTable[userDefinedLevel].find(name);
         if (symbol)
         {
             return symbol;
@@ -280,17 +258,17 @@ TFunction *TSymbolTable::findUserDefinedFunction(const ImmutableString &name) co
 {
     // User-defined functions are always declared at the global level.
     ASSERT(!mTable.empty());
-    return static_cast<TFunction *>(mTable[0]->find(name));
+    return static_cast<TFunction *>(mTable[0].find(name));
 }
 
 const TSymbol *TSymbolTable::findGlobal(const ImmutableString &name) const
 {
     ASSERT(!mTable.empty());
-    return mTable[0]->find(name);
+    return mTable[0].find(name);
 }
 
 const TSymbol *TSymbolTable::findGlobalWithConversion(
-    const std::vector<ImmutableString> &names) const
+    const TVector<ImmutableString> &names) const
 {
     for (const ImmutableString &name : names)
     {
@@ -301,7 +279,7 @@ const TSymbol *TSymbolTable::findGlobalWithConversion(
     return nullptr;
 }
 
-const TSymbol *TSymbolTable::findBuiltInWithConversion(const std::vector<ImmutableString> &names,
+const TSymbol *TSymbolTable::findBuiltInWithConversion(const TVector<ImmutableString> &names,
                                                        int shaderVersion) const
 {
     for (const ImmutableString &name : names)
@@ -321,7 +299,7 @@ bool TSymbolTable::declare(TSymbol *symbol)
     ASSERT(symbol->symbolType() == SymbolType::UserDefined ||
            (symbol->symbolType() == SymbolType::BuiltIn && IsRedeclarableBuiltIn(symbol->name())));
     ASSERT(!symbol->isFunction());
-    return mTable.back()->insert(symbol);
+    return mTable.back().insert(symbol);
 }
 
 bool TSymbolTable::declareInternal(TSymbol *symbol)
@@ -329,7 +307,7 @@ bool TSymbolTable::declareInternal(TSymbol *symbol)
     ASSERT(!mTable.empty());
     ASSERT(symbol->symbolType() == SymbolType::AngleInternal);
     ASSERT(!symbol->isFunction());
-    return mTable.back()->insert(symbol);
+    return mTable.back().insert(symbol);
 }
 
 void TSymbolTable::declareUserDefinedFunction(TFunction *function, bool insertUnmangledName)
@@ -338,16 +316,16 @@ void TSymbolTable::declareUserDefinedFunction(TFunction *function, bool insertUn
     if (insertUnmangledName)
     {
         // Insert the unmangled name to detect potential future redefinition as a variable.
-        mTable[0]->insertUnmangled(function);
+        mTable[0].insertUnmangled(function);
     }
-    mTable[0]->insert(function);
+    mTable[0].insert(function);
 }
 
 void TSymbolTable::setDefaultPrecision(TBasicType type, TPrecision prec)
 {
     int indexOfLastElement = static_cast<int>(mPrecisionStack.size()) - 1;
     // Uses map operator [], overwrites the current value
-    (*mPrecisionStack[indexOfLastElement])[type] = prec;
+    mPrecisionStack[indexOfLastElement][type] = prec;
 }
 
 TPrecision TSymbolTable::getDefaultPrecision(TBasicType type) const
@@ -364,8 +342,8 @@ TPrecision TSymbolTable::getDefaultPrecision(TBasicType type) const
     TPrecision prec = EbpUndefined;
     while (level >= 0)
     {
-        PrecisionStackLevel::iterator it = mPrecisionStack[level]->find(baseType);
-        if (it != mPrecisionStack[level]->end())
+        PrecisionStackLevel::const_iterator it = mPrecisionStack[level].find(baseType);
+        if (it != mPrecisionStack[level].end())
         {
             prec = (*it).second;
             break;
@@ -401,7 +379,7 @@ void TSymbolTable::initializeBuiltIns(sh::GLenum type,
     mResources  = resources;
 
     // We need just one precision stack level for predefined precisions.
-    mPrecisionStack.emplace_back(new PrecisionStackLevel);
+    mPrecisionStack.emplace_back();
 
     if (IsDesktopGLSpec(spec))
     {
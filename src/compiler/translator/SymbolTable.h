@@ -274,10 +274,10 @@ class TSymbolTable : angle::NonCopyable, TSymbolTableBase
     TFunction *findUserDefinedFunction(const ImmutableString &name) const;
 
     const TSymbol *findGlobal(const ImmutableString &name) const;
-    const TSymbol *findGlobalWithConversion(const std::vector<ImmutableString> &names) const;
+    const TSymbol *findGlobalWithConversion(const TVector<ImmutableString> &names) const;
 
     const TSymbol *findBuiltIn(const ImmutableString &name, int shaderVersion) const;
-    const TSymbol *findBuiltInWithConversion(const std::vector<ImmutableString> &names,
+    const TSymbol *findBuiltInWithConversion(const TVector<ImmutableString> &names,
                                              int shaderVersion) const;
 
     void setDefaultPrecision(TBasicType type, TPrecision prec);
@@ -323,7 +323,29 @@ class TSymbolTable : angle::NonCopyable, TSymbolTableBase
 
     int nextUniqueIdValue();
 
-    class TSymbolTableLevel;
+    // A single scope of the symbol table. Defined in the header so that scopes can be stored by
+    // value in mTable; one less pointer to chase on every symbol lookup.
+    class TSymbolTableLevel
+    {
+      public:
+        TSymbolTableLevel() = default;
+
+        bool insert(TSymbol *symbol);
+
+        // Insert a function using its unmangled name as the key.
+        void insertUnmangled(TFunction *function);
+
+        TSymbol *find(const ImmutableString &name) const;
+
+      private:
+        using tLevel        = TUnorderedMap<ImmutableString,
+                                     TSymbol *,
+                                     ImmutableString::FowlerNollVoHash<sizeof(size_t)>>;
+        using tLevelPair    = const tLevel::value_type;
+        using tInsertResult = std::pair<tLevel::iterator, bool>;
+
+        tLevel level;
+    };
 
     void initSamplerDefaultPrecision(TBasicType samplerType);
 
@@ -333,12 +355,12 @@ class TSymbolTable : angle::NonCopyable, TSymbolTableBase
 
     VariableMetadata *getOrCreateVariableMetadata(const TVariable &variable);
 
-    std::vector<std::unique_ptr<TSymbolTableLevel>> mTable;
+    std::vector<TSymbolTableLevel> mTable;
 
     // There's one precision stack level for predefined precisions and then one level for each scope
     // in table.
     typedef TMap<TBasicType, TPrecision> PrecisionStackLevel;
-    std::vector<std::unique_ptr<PrecisionStackLevel>> mPrecisionStack;
+    std::vector<PrecisionStackLevel> mPrecisionStack;
 
     bool mGlobalInvariant;
 
@@ -20,150 +20,119 @@
 namespace sh
 {
 
+namespace
+{
+
+// Names of the basic types, indexed by TBasicType.  A flat table keeps getBasicString() to a
+// single indexed load instead of a large switch.  Must be kept in sync with the TBasicType
+// enumeration in BaseTypes.h.
+constexpr const char *kBasicTypeNames[] = {
+    "void",                        // EbtVoid
+    "float",                       // EbtFloat
+    "double",                      // EbtDouble
+    "int",                         // EbtInt
+    "uint",                        // EbtUInt
+    "bool",                        // EbtBool
+    "atomic_uint",                 // EbtAtomicCounter
+    "yuvCscStandardEXT",           // EbtYuvCscStandardEXT
+    "sampler2D",                   // EbtSampler2D
+    "sampler3D",                   // EbtSampler3D
+    "samplerCube",                 // EbtSamplerCube
+    "sampler2DArray",              // EbtSampler2DArray
+    "samplerExternalOES",          // EbtSamplerExternalOES
+    "__samplerExternal2DY2YEXT",   // EbtSamplerExternal2DY2YEXT
+    "sampler2DRect",               // EbtSampler2DRect
+    "sampler2DMS",                 // EbtSampler2DMS
+    "sampler2DMSArray",            // EbtSampler2DMSArray
+    "isampler2D",                  // EbtISampler2D
+    "isampler3D",                  // EbtISampler3D
+    "isamplerCube",                // EbtISamplerCube
+    "isampler2DArray",             // EbtISampler2DArray
+    "isampler2DMS",                // EbtISampler2DMS
+    "isampler2DMSArray",           // EbtISampler2DMSArray
+    "usampler2D",                  // EbtUSampler2D
+    "usampler3D",                  // EbtUSampler3D
+    "usamplerCube",                // EbtUSamplerCube
+    "usampler2DArray",             // EbtUSampler2DArray
+    "usampler2DMS",                // EbtUSampler2DMS
+    "usampler2DMSArray",           // EbtUSampler2DMSArray
+    "sampler2DShadow",             // EbtSampler2DShadow
+    "samplerCubeShadow",           // EbtSamplerCubeShadow
+    "sampler2DArrayShadow",        // EbtSampler2DArrayShadow
+    "sampler1D",                   // EbtSampler1D
+    "sampler1DArray",              // EbtSampler1DArray
+    "sampler1DArrayShadow",        // EbtSampler1DArrayShadow
+    "samplerBuffer",               // EbtSamplerBuffer
+    "samplerCubeArray",            // EbtSamplerCubeArray
+    "samplerCubeArrayShadow",      // EbtSamplerCubeArrayShadow
+    "sampler1DShadow",             // EbtSampler1DShadow
+    "sampler2DRectShadow",         // EbtSampler2DRectShadow
+    "isampler1D",                  // EbtISampler1D
+    "isampler1DArray",             // EbtISampler1DArray
+    "isampler2DRect",              // EbtISampler2DRect
+    "isamplerBuffer",              // EbtISamplerBuffer
+    "isamplerCubeArray",           // EbtISamplerCubeArray
+    "usampler1D",                  // EbtUSampler1D
+    "usampler1DArray",             // EbtUSampler1DArray
+    "usampler2DRect",              // EbtUSampler2DRect
+    "usamplerBuffer",              // EbtUSamplerBuffer
+    "usamplerCubeArray",           // EbtUSamplerCubeArray
+    "samplerVideoWEBGL",           // EbtSamplerVideoWEBGL
+    "image2D",                     // EbtImage2D
+    "image3D",                     // EbtImage3D
+    "image2DArray",                // EbtImage2DArray
+    "imageCube",                   // EbtImageCube
+    "image1D",                     // EbtImage1D
+    "image1DArray",                // EbtImage1DArray
+    "image2DMS",                   // EbtImage2DMS
+    "image2DMSArray",              // EbtImage2DMSArray
+    "imageCubeArray",              // EbtImageCubeArray
+    "image2DRect",                 // EbtImageRect
+    "imageBuffer",                 // EbtImageBuffer
+    "iimage2D",                    // EbtIImage2D
+    "iimage3D",                    // EbtIImage3D
+    "iimage2DArray",               // EbtIImage2DArray
+    "iimageCube",                  // EbtIImageCube
+    "iimage1D",                    // EbtIImage1D
+    "iimage1DArray",               // EbtIImage1DArray
+    "iimage2DMS",                  // EbtIImage2DMS
+    "iimage2DMSArray",             // EbtIImage2DMSArray
+    "iimageCubeArray",             // EbtIImageCubeArray
+    "iimage2DRect",                // EbtIImageRect
+    "iimageBuffer",                // EbtIImageBuffer
+    "uimage2D",                    // EbtUImage2D
+    "uimage3D",                    // EbtUImage3D
+    "uimage2DArray",               // EbtUImage2DArray
+    "uimageCube",                  // EbtUImageCube
+    "uimage1D",                    // EbtUImage1D
+    "uimage1DArray",               // EbtUImage1DArray
+    "uimage2DMS",                  // EbtUImage2DMS
+    "uimage2DMSArray",             // EbtUImage2DMSArray
+    "uimageCubeArray",             // EbtUImageCubeArray
+    "uimage2DRect",                // EbtUImageRect
+    "uimageBuffer",                // EbtUImageBuffer
+    "pixelLocalANGLE",             // EbtPixelLocalANGLE
+    "ipixelLocalANGLE",            // EbtIPixelLocalANGLE
+    "upixelLocalANGLE",            // EbtUPixelLocalANGLE
+    "subpassInput",                // EbtSubpassInput
+    "isubpassInput",               // EbtISubpassInput
+    "usubpassInput",               // EbtUSubpassInput
+    "subpassInputMS",              // EbtSubpassInputMS
+    "isubpassInputMS",             // EbtISubpassInputMS
+    "usubpassInputMS",             // EbtUSubpassInputMS
+    "structure",                   // EbtStruct
+    "interface block",             // EbtInterfaceBlock
+};
+
+static_assert(ArraySize(kBasicTypeNames) == static_cast<size_t>(EbtLast) + 1,
+              "kBasicTypeNames is out of sync with TBasicType");
+
+}  // anonymous namespace
+
 const char *getBasicString(TBasicType t)
 {
-    switch (t)
-    {
-        case EbtVoid:
-            return "void";
-        case EbtFloat:
-            return "float";
-        case EbtInt:
-            return "int";
-        case EbtUInt:
-            return "uint";
-        case EbtBool:
-            return "bool";
-        case EbtYuvCscStandardEXT:
-            return "yuvCscStandardEXT";
-        case EbtSampler2D:
-            return "sampler2D";
-        case EbtSampler3D:
-            return "sampler3D";
-        case EbtSamplerCube:
-            return "samplerCube";
-        case EbtSamplerExternalOES:
-            return "samplerExternalOES";
-        case EbtSamplerExternal2DY2YEXT:
-            return "__samplerExternal2DY2YEXT";
-        case EbtSampler2DRect:
-            return "sampler2DRect";
-        case EbtSampler2DArray:
-            return "sampler2DArray";
-        case EbtSampler2DMS:
-            return "sampler2DMS";
-        case EbtSampler2DMSArray:
-            return "sampler2DMSArray";
-        case EbtSamplerCubeArray:
-            return "samplerCubeArray";
-        case EbtSamplerBuffer:
-            return "samplerBuffer";
-        case EbtISampler2D:
-            return "isampler2D";
-        case EbtISampler3D:
-            return "isampler3D";
-        case EbtISamplerCube:
-            return "isamplerCube";
-        case EbtISampler2DArray:
-            return "isampler2DArray";
-        case EbtISampler2DMS:
-            return "isampler2DMS";
-        case EbtISampler2DMSArray:
-            return "isampler2DMSArray";
-        case EbtISamplerCubeArray:
-            return "isamplerCubeArray";
-        case EbtISamplerBuffer:
-            return "isamplerBuffer";
-        case EbtUSampler2D:
-            return "usampler2D";
-        case EbtUSampler3D:
-            return "usampler3D";
-        case EbtUSamplerCube:
-            return "usamplerCube";
-        case EbtUSampler2DArray:
-            return "usampler2DArray";
-        case EbtUSampler2DMS:
-            return "usampler2DMS";
-        case EbtUSampler2DMSArray:
-            return "usampler2DMSArray";
-        case EbtUSamplerCubeArray:
-            return "usamplerCubeArray";
-        case EbtUSamplerBuffer:
-            return "usamplerBuffer";
-        case EbtSampler2DShadow:
-            return "sampler2DShadow";
-        case EbtSamplerCubeShadow:
-            return "samplerCubeShadow";
-        case EbtSampler2DArrayShadow:
-            return "sampler2DArrayShadow";
-        case EbtSamplerCubeArrayShadow:
-            return "samplerCubeArrayShadow";
-        case EbtStruct:
-            return "structure";
-        case EbtInterfaceBlock:
-            return "interface block";
-        case EbtImage2D:
-            return "image2D";
-        case EbtIImage2D:
-            return "iimage2D";
-        case EbtUImage2D:
-            return "uimage2D";
-        case EbtImage3D:
-            return "image3D";
-        case EbtIImage3D:
-            return "iimage3D";
-        case EbtUImage3D:
-            return "uimage3D";
-        case EbtImage2DArray:
-            return "image2DArray";
-        case EbtIImage2DArray:
-            return "iimage2DArray";
-        case EbtUImage2DArray:
-            return "uimage2DArray";
-        case EbtImageCube:
-            return "imageCube";
-        case EbtIImageCube:
-            return "iimageCube";
-        case EbtUImageCube:
-            return "uimageCube";
-        case EbtImageCubeArray:
-            return "imageCubeArray";
-        case EbtIImageCubeArray:
-            return "iimageCubeArray";
-        case EbtUImageCubeArray:
-            return "uimageCubeArray";
-        case EbtImageBuffer:
-            return "imageBuffer";
-        case EbtIImageBuffer:
-            return "iimageBuffer";
-        case EbtUImageBuffer:
-            return "uimageBuffer";
-        case EbtAtomicCounter:
-            return "atomic_uint";
-        case EbtSamplerVideoWEBGL:
-            return "samplerVideoWEBGL";
-        case EbtPixelLocalANGLE:
-            return "pixelLocalANGLE";
-        case EbtIPixelLocalANGLE:
-            return "ipixelLocalANGLE";
-        case EbtUPixelLocalANGLE:
-            return "upixelLocalANGLE";
-        case EbtSubpassInput:
-            return "subpassInput";
-        case EbtISubpassInput:
-            return "isubpassInput";
-        case EbtUSubpassInput:
-            return "usubpassInput";
-        case EbtSubpassInputMS:
-            return "subpassInputMS";
-        case EbtISubpassInputMS:
-            return "isubpassInputMS";
-        case EbtUSubpassInputMS:
-            return "usubpassInputMS";
-        default:
-            UNREACHABLE();
-            return "unknown type";
-    }
+    ASSERT(static_cast<size_t>(t) < ArraySize(kBasicTypeNames));
+    return kBasicTypeNames[t];
 }
 
 // TType implementation.
@@ -186,10 +155,10 @@ TType::TType(const TPublicType &p)
       layoutQualifier(p.layoutQualifier),
       primarySize(p.getPrimarySize()),
       secondarySize(p.getSecondarySize()),
+      mIsStructSpecifier(false),
       mArraySizesStorage(nullptr),
       mInterfaceBlock(nullptr),
       mStructure(nullptr),
-      mIsStructSpecifier(false),
       mInterfaceBlockFieldIndex(0),
       mMangledName(nullptr)
 {
@@ -798,10 +767,22 @@ void TType::createSamplerSymbols(const ImmutableString &namePrefix,
 }
 
 TFieldListCollection::TFieldListCollection(const TFieldList *fields)
-    : mFields(fields), mObjectSize(0), mDeepestNesting(0)
+    : mFields(fields),
+      mObjectSize(0),
+      mDeepestNesting(0),
+      mContainsArrays(-1),
+      mContainsMatrices(-1),
+      mContainsSamplers(-1)
 {}
 
 bool TFieldListCollection::containsArrays() const
+{
+    if (mContainsArrays < 0)
+        mContainsArrays = calculateContainsArrays() ? 1 : 0;
+    return mContainsArrays != 0;
+}
+
+bool TFieldListCollection::calculateContainsArrays() const
 {
     for (const auto *field : *mFields)
     {
@@ -813,6 +794,13 @@ bool TFieldListCollection::containsArrays() const
 }
 
 bool TFieldListCollection::containsMatrices() const
+{
+    if (mContainsMatrices < 0)
+        mContainsMatrices = calculateContainsMatrices() ? 1 : 0;
+    return mContainsMatrices != 0;
+}
+
+bool TFieldListCollection::calculateContainsMatrices() const
 {
     for (const auto *field : *mFields)
     {
@@ -835,6 +823,13 @@ bool TFieldListCollection::containsType(TBasicType type) const
 }
 
 bool TFieldListCollection::containsSamplers() const
+{
+    if (mContainsSamplers < 0)
+        mContainsSamplers = calculateContainsSamplers() ? 1 : 0;
+    return mContainsSamplers != 0;
+}
+
+bool TFieldListCollection::calculateContainsSamplers() const
 {
     for (const auto *field : *mFields)
     {
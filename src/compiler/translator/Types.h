@@ -79,10 +79,18 @@ class TFieldListCollection : angle::NonCopyable
     size_t calculateObjectSize() const;
     int calculateDeepestNesting() const;
     TString buildMangledFieldList() const;
+    bool calculateContainsArrays() const;
+    bool calculateContainsMatrices() const;
+    bool calculateContainsSamplers() const;
 
     mutable size_t mObjectSize;
     mutable int mDeepestNesting;
     mutable TString mMangledFieldList;
+    // Lazily computed caches; -1 means not computed yet. The field list does not change after
+    // these queries are first made, so it is safe to cache the results.
+    mutable int8_t mContainsArrays;
+    mutable int8_t mContainsMatrices;
+    mutable int8_t mContainsSamplers;
 };
 
 //
@@ -120,11 +128,11 @@ class TType
           layoutQualifier(TLayoutQualifier::Create()),
           primarySize(ps),
           secondarySize(ss),
+          mIsStructSpecifier(false),
           mArraySizes(arraySizes),
           mArraySizesStorage(nullptr),
           mInterfaceBlock(nullptr),
           mStructure(nullptr),
-          mIsStructSpecifier(false),
           mInterfaceBlockFieldIndex(0),
           mMangledName(mangledName)
     {}
@@ -140,11 +148,11 @@ class TType
           layoutQualifier(t.layoutQualifier),
           primarySize(t.primarySize),
           secondarySize(t.secondarySize),
+          mIsStructSpecifier(t.mIsStructSpecifier),
           mArraySizes(t.mArraySizes),
           mArraySizesStorage(t.mArraySizesStorage),
           mInterfaceBlock(t.mInterfaceBlock),
           mStructure(t.mStructure),
-          mIsStructSpecifier(t.mIsStructSpecifier),
           mInterfaceBlockFieldIndex(0),
           mMangledName(t.mMangledName)
     {
@@ -384,6 +392,10 @@ class TType
     uint8_t primarySize;    // size of vector or cols matrix
     uint8_t secondarySize;  // rows of a matrix
 
+    // Kept with the other small members so it packs into the padding after secondarySize instead
+    // of sitting alone between pointer-sized members.
+    bool mIsStructSpecifier;
+
     // Used to make an array type. Outermost array size is stored at the end of the vector. Having 0
     // in this vector means an unsized array.
     TSpan<const unsigned int> mArraySizes;
@@ -401,7 +413,6 @@ class TType
 
     // nullptr unless this is a struct
     const TStructure *mStructure;
-    bool mIsStructSpecifier;
 
     // If this is a field of a nameless interface block, this would indicate which member it's
     // refering to.
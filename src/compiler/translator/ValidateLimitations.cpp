@@ -6,6 +6,8 @@
 
 #include "compiler/translator/ValidateLimitations.h"
 
+#include <unordered_set>
+
 #include "angle_gl.h"
 #include "compiler/translator/Diagnostics.h"
 #include "compiler/translator/ParseContext.h"
@@ -40,7 +42,7 @@ int GetLoopSymbolId(TIntermLoop *loop)
 class ValidateConstIndexExpr : public TIntermTraverser
 {
   public:
-    ValidateConstIndexExpr(const std::vector<int> &loopSymbols)
+    ValidateConstIndexExpr(const std::unordered_set<int> &loopSymbols)
         : TIntermTraverser(true, false, false), mValid(true), mLoopSymbolIds(loopSymbols)
     {}
 
@@ -53,15 +55,14 @@ class ValidateConstIndexExpr : public TIntermTraverser
         // constant index expression.
         if (mValid)
         {
-            bool isLoopSymbol = std::find(mLoopSymbolIds.begin(), mLoopSymbolIds.end(),
-                                          symbol->uniqueId().get()) != mLoopSymbolIds.end();
+            bool isLoopSymbol = mLoopSymbolIds.count(symbol->uniqueId().get()) != 0;
             mValid            = (symbol->getQualifier() == EvqConst) || isLoopSymbol;
         }
     }
 
   private:
     bool mValid;
-    const std::vector<int> mLoopSymbolIds;
+    const std::unordered_set<int> &mLoopSymbolIds;
 };
 
 // Traverses intermediate tree to ensure that the shader does not exceed the
@@ -98,7 +99,7 @@ class ValidateLimitationsTraverser : public TLValueTrackingTraverser
 
     sh::GLenum mShaderType;
     TDiagnostics *mDiagnostics;
-    std::vector<int> mLoopSymbolIds;
+    std::unordered_set<int> mLoopSymbolIds;
 };
 
 ValidateLimitationsTraverser::ValidateLimitationsTraverser(sh::GLenum shaderType,
@@ -147,9 +148,10 @@ bool ValidateLimitationsTraverser::visitLoop(Visit, TIntermLoop *node)
     TIntermNode *body = node->getBody();
     if (body != nullptr)
     {
-        mLoopSymbolIds.push_back(GetLoopSymbolId(node));
+        const int loopSymbolId = GetLoopSymbolId(node);
+        mLoopSymbolIds.insert(loopSymbolId);
         body->traverse(this);
-        mLoopSymbolIds.pop_back();
+        mLoopSymbolIds.erase(loopSymbolId);
     }
 
     // The loop is fully processed - no need to visit children.
@@ -170,8 +172,7 @@ void ValidateLimitationsTraverser::error(TSourceLoc loc,
 
 bool ValidateLimitationsTraverser::isLoopIndex(TIntermSymbol *symbol)
 {
-    return std::find(mLoopSymbolIds.begin(), mLoopSymbolIds.end(), symbol->uniqueId().get()) !=
-           mLoopSymbolIds.end();
+    return mLoopSymbolIds.count(symbol->uniqueId().get()) != 0;
 }
 
 bool ValidateLimitationsTraverser::validateLoopType(TIntermLoop *node)
@@ -12,7 +12,7 @@
 namespace sh
 {
 
-class TranslatorESSL : public TCompiler
+class TranslatorESSL final : public TCompiler
 {
   public:
     TranslatorESSL(sh::GLenum type, ShShaderSpec spec);
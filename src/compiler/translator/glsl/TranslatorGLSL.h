@@ -12,7 +12,7 @@
 namespace sh
 {
 
-class TranslatorGLSL : public TCompiler
+class TranslatorGLSL final : public TCompiler
 {
   public:
     TranslatorGLSL(sh::GLenum type, ShShaderSpec spec, ShShaderOutput output);
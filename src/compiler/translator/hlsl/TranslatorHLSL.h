@@ -12,7 +12,7 @@
 namespace sh
 {
 
-class TranslatorHLSL : public TCompiler
+class TranslatorHLSL final : public TCompiler
 {
   public:
     TranslatorHLSL(sh::GLenum type, ShShaderSpec spec, ShShaderOutput output);
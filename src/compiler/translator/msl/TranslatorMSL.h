@@ -172,7 +172,7 @@ class TranslatorMetalReflection
     uniformBufferBindingMap uniformBufferBindings;
 };
 
-class TranslatorMSL : public TCompiler
+class TranslatorMSL final : public TCompiler
 {
   public:
     TranslatorMSL(sh::GLenum type, ShShaderSpec spec, ShShaderOutput output);
@@ -837,20 +837,25 @@ class RewriteANGLEToEXTTraverser : public RewritePLSTraverser
     // block and establishes their indices.
     void rewriteDeclarations(TCompiler *compiler, TIntermBlock *root, TIntermBlock *mainBody)
     {
-        // Create EXT fields for ANGLE uniforms, then delete the ANGLE uniforms.
+        // Create EXT fields for ANGLE uniforms, then delete the ANGLE uniforms. Surviving nodes
+        // are compacted in place in a single pass instead of erasing from the middle of the
+        // sequence once per PLS declaration.
         TIntermSequence &rootSequence = *root->getSequence();
+        size_t keptCount              = 0;
         for (size_t i = 0; i < rootSequence.size(); ++i)
         {
             TIntermNode *node        = rootSequence[i];
             TIntermDeclaration *decl = node->getAsDeclarationNode();
             if (decl == nullptr)
             {
+                rootSequence[keptCount++] = node;
                 continue;
             }
             TIntermTyped *declVariable = (decl->getSequence())->front()->getAsTyped();
             ASSERT(declVariable);
             if (!IsPixelLocal(declVariable->getBasicType()))
             {
+                rootSequence[keptCount++] = node;
                 continue;
             }
             // Create a native pixel local storage field that describes this plane.
@@ -887,9 +892,8 @@ class RewriteANGLEToEXTTraverser : public RewritePLSTraverser
             mFieldsEXT.insertNew(
                 symbolANGLE,
                 FieldEXT(typeEXT, varANGLE.name(), symbolANGLE->getLine(), varANGLE.symbolType()));
-            rootSequence.erase(rootSequence.begin() + i);
-            --i;
         }
+        rootSequence.resize(keptCount);
 
         // Create the global __pixel_localEXT interface block and save each field's index.
         TFieldList *fieldsEXT = new TFieldList;